@@ -0,0 +1,22 @@
+#pragma once
+
+#include <Arduino.h>
+#include <FS.h>
+#include <config_parser.h>
+
+// Human-editable configuration file on the SD card
+#define CONFIG_FILE_PATH "/pomodoro/config.txt"
+
+// Load config from the NVS cache with a single read, no text parsing.
+// Returns false (config untouched) if there is no cache or it fails validation.
+bool configLoadCached(PomodoroConfig &config);
+
+// Reset config to the defaults and cache them with a "no file" stamp,
+// so units without an SD card don't retry the mount on every boot.
+// Returns false if the NVS write failed.
+bool configSaveDefaults(PomodoroConfig &config);
+
+// Re-compile the config file into the NVS cache if its size or mtime changed.
+// fs must already be mounted. Without a usable cache an unreadable file caches the defaults.
+// Returns true if the cache was rewritten, false if unchanged, kept or the NVS write failed.
+bool configSyncFromFile(fs::FS &fs, PomodoroConfig &config);
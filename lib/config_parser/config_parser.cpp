@@ -0,0 +1,199 @@
+#include "config_parser.h"
+
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Display geometry limits (540px wide portrait screen)
+#define CONFIG_OUTER_DOT_COUNT 60   // One outer dot per second
+#define CONFIG_OUTER_DOT_SIZE 9     // fillCircle(..., 4, ...)
+#define CONFIG_INNER_DOT_SIZE 13    // fillCircle(..., 6, ...)
+#define CONFIG_MAX_OUTER_RADIUS 260
+#define CONFIG_MIN_OUTER_RADIUS 90  // Smallest ring that fits 60 outer dots
+#define CONFIG_MIN_INNER_RADIUS 60
+#define CONFIG_MIN_RING_GAP 20
+
+static void warnf(ConfigWarningHandler warn, const char *format, ...) {
+  if (!warn) return;
+  char message[128];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(message, sizeof(message), format, args);
+  va_end(args);
+  warn(message);
+}
+
+static bool isSpace(char c) {
+  return c == ' ' || c == '\t' || c == '\r';
+}
+
+// Shrink [start, end) to drop surrounding whitespace
+static void trim(const char *&start, const char *&end) {
+  while (start < end && isSpace(*start)) start++;
+  while (end > start && isSpace(end[-1])) end--;
+}
+
+static bool keyIs(const char *key, size_t length, const char *name) {
+  return strlen(name) == length && strncmp(key, name, length) == 0;
+}
+
+// Parse a whole decimal number within [minValue, maxValue]
+static bool parseNumber(const char *start, const char *end, long minValue, long maxValue, long &value) {
+  char buffer[16];
+  size_t length = end - start;
+  if (length == 0 || length >= sizeof(buffer)) {
+    return false;
+  }
+  memcpy(buffer, start, length);
+  buffer[length] = '\0';
+
+  char *parsedEnd = nullptr;
+  long parsed = strtol(buffer, &parsedEnd, 10);
+  if (*parsedEnd != '\0' || parsed < minValue || parsed > maxValue) {
+    return false;
+  }
+  value = parsed;
+  return true;
+}
+
+// Apply one "key = value" line. Invalid lines are reported and leave the default in place.
+static void parseLine(const char *start, const char *end, int lineNumber,
+                      PomodoroConfig &config, ConfigWarningHandler warn) {
+  const char *comment = (const char *)memchr(start, '#', end - start);
+  if (comment) {
+    end = comment;
+  }
+  trim(start, end);
+  if (start == end) {
+    return;
+  }
+
+  const char *separator = (const char *)memchr(start, '=', end - start);
+  if (!separator) {
+    warnf(warn, "line %d: missing '='", lineNumber);
+    return;
+  }
+  const char *key = start;
+  const char *keyEnd = separator;
+  const char *text = separator + 1;
+  const char *textEnd = end;
+  trim(key, keyEnd);
+  trim(text, textEnd);
+  size_t keyLength = keyEnd - key;
+
+  long value = 0;
+  bool valid = false;
+  if (keyIs(key, keyLength, "preset_1_min") || keyIs(key, keyLength, "preset_2_min") ||
+      keyIs(key, keyLength, "preset_3_min")) {
+    valid = parseNumber(text, textEnd, 1, 99, value);
+    if (valid) config.presetMinutes[key[7] - '1'] = value;
+  } else if (keyIs(key, keyLength, "sleep_timeout_sec")) {
+    valid = parseNumber(text, textEnd, 30, 24 * 60 * 60, value);
+    if (valid) config.sleepTimeoutMs = value * 1000;
+  } else if (keyIs(key, keyLength, "battery_check_sec")) {
+    valid = parseNumber(text, textEnd, 5, 60 * 60, value);
+    if (valid) config.batteryCheckIntervalMs = value * 1000;
+  } else if (keyIs(key, keyLength, "anti_ghost_min")) {
+    valid = parseNumber(text, textEnd, 0, 99, value);
+    if (valid) config.antiGhostMinutes = value;
+  } else if (keyIs(key, keyLength, "speaker_volume")) {
+    valid = parseNumber(text, textEnd, 0, 255, value);
+    if (valid) config.speakerVolume = value;
+  } else if (keyIs(key, keyLength, "outer_radius")) {
+    valid = parseNumber(text, textEnd, CONFIG_MIN_OUTER_RADIUS, CONFIG_MAX_OUTER_RADIUS, value);
+    if (valid) config.outerRadius = value;
+  } else if (keyIs(key, keyLength, "inner_radius")) {
+    valid = parseNumber(text, textEnd, CONFIG_MIN_INNER_RADIUS, CONFIG_MAX_OUTER_RADIUS - CONFIG_MIN_RING_GAP, value);
+    if (valid) config.innerRadius = value;
+  } else {
+    warnf(warn, "line %d: unknown key '%.*s'", lineNumber, (int)keyLength, key);
+    return;
+  }
+
+  if (!valid) {
+    warnf(warn, "line %d: invalid value '%.*s' for %.*s, using default",
+          lineNumber, (int)(textEnd - text), text, (int)keyLength, key);
+  }
+}
+
+void configSetDefaults(PomodoroConfig &config) {
+  config.sleepTimeoutMs = 5 * 60 * 1000;       // 5 minutes
+  config.batteryCheckIntervalMs = 60 * 1000;   // 60 seconds
+  config.presetMinutes[0] = 25;
+  config.presetMinutes[1] = 5;
+  config.presetMinutes[2] = 30;
+  config.antiGhostMinutes = 5;
+  config.outerRadius = 220;
+  config.innerRadius = 170;
+  config.speakerVolume = 200;
+}
+
+bool configDotsFit(int count, int radius, int diameter) {
+  if (count <= 1) {
+    return true;
+  }
+  // Distance between neighbouring dot centres must cover one dot
+  return 2 * radius * sin(M_PI / count) >= diameter;
+}
+
+void configParse(const char *text, size_t length, PomodoroConfig &config, ConfigWarningHandler warn) {
+  configSetDefaults(config);
+
+  const char *end = text + length;
+  // Skip the UTF-8 byte order mark some editors (e.g. Notepad) put at the start
+  if (length >= 3 && memcmp(text, "\xEF\xBB\xBF", 3) == 0) {
+    text += 3;
+  }
+
+  int lineNumber = 0;
+  while (text < end) {
+    const char *lineEnd = (const char *)memchr(text, '\n', end - text);
+    if (!lineEnd) {
+      lineEnd = end;
+    }
+    lineNumber++;
+    parseLine(text, lineEnd, lineNumber, config, warn);
+    text = lineEnd + 1;
+  }
+
+  PomodoroConfig defaults;
+  configSetDefaults(defaults);
+
+  // Rings must not overlap each other
+  if (config.innerRadius + CONFIG_MIN_RING_GAP > config.outerRadius) {
+    warnf(warn, "inner_radius %d too close to outer_radius %d, using default radii",
+          config.innerRadius, config.outerRadius);
+    config.outerRadius = defaults.outerRadius;
+    config.innerRadius = defaults.innerRadius;
+  }
+
+  // The inner ring shows one dot per minute, every preset has to fit on it
+  for (int i = 0; i < CONFIG_PRESET_COUNT; i++) {
+    if (config.presetMinutes[i] != defaults.presetMinutes[i] &&
+        !configDotsFit(config.presetMinutes[i], config.innerRadius, CONFIG_INNER_DOT_SIZE)) {
+      warnf(warn, "preset_%d_min %d does not fit on inner_radius %d, using default",
+            i + 1, config.presetMinutes[i], config.innerRadius);
+      config.presetMinutes[i] = defaults.presetMinutes[i];
+    }
+  }
+
+  // Even the default presets need room, otherwise the ring itself is too small
+  for (int i = 0; i < CONFIG_PRESET_COUNT; i++) {
+    if (!configDotsFit(config.presetMinutes[i], config.innerRadius, CONFIG_INNER_DOT_SIZE)) {
+      warnf(warn, "inner_radius %d too small for the presets, using default radii", config.innerRadius);
+      config.outerRadius = defaults.outerRadius;
+      config.innerRadius = defaults.innerRadius;
+      break;
+    }
+  }
+
+  // Guaranteed by CONFIG_MIN_OUTER_RADIUS, kept as a safety net
+  if (!configDotsFit(CONFIG_OUTER_DOT_COUNT, config.outerRadius, CONFIG_OUTER_DOT_SIZE)) {
+    warnf(warn, "outer_radius %d too small for %d dots, using default radii",
+          config.outerRadius, CONFIG_OUTER_DOT_COUNT);
+    config.outerRadius = defaults.outerRadius;
+    config.innerRadius = defaults.innerRadius;
+  }
+}
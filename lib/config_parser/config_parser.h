@@ -0,0 +1,33 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Plain C++ (no Arduino dependencies) so it can be unit tested on the host
+
+#define CONFIG_PRESET_COUNT 3
+
+// Runtime settings. Compiled from the SD card file and cached in NVS as a binary blob,
+// so changing the layout requires bumping CONFIG_BLOB_VERSION in config.cpp.
+struct PomodoroConfig {
+  uint32_t sleepTimeoutMs;                     // Inactivity before deep sleep
+  uint32_t batteryCheckIntervalMs;             // Battery polling interval
+  uint16_t presetMinutes[CONFIG_PRESET_COUNT]; // Preset buttons, first one is the boot default
+  uint16_t antiGhostMinutes;                   // Full refresh cadence while running (0 = off)
+  uint16_t outerRadius;                        // Seconds ring radius in pixels
+  uint16_t innerRadius;                        // Minutes ring radius in pixels
+  uint8_t speakerVolume;                       // 0-255
+};
+
+// Receives one message per rejected line or setting (may be nullptr)
+typedef void (*ConfigWarningHandler)(const char *message);
+
+// Fill config with the built-in defaults
+void configSetDefaults(PomodoroConfig &config);
+
+// Parse config file text ("key = value" lines, '#' comments) on top of the defaults.
+// text does not need to be null-terminated. Invalid settings keep their default.
+void configParse(const char *text, size_t length, PomodoroConfig &config, ConfigWarningHandler warn);
+
+// True if count dots of the given diameter fit on a ring without touching
+bool configDotsFit(int count, int radius, int diameter);
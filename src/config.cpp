@@ -0,0 +1,158 @@
+#include "config.h"
+
+#include <Preferences.h>
+#include <esp_rom_crc.h>
+
+// NVS cache location
+#define CONFIG_NVS_NAMESPACE "pomodoro"
+#define CONFIG_NVS_KEY "config"
+
+// Cache blob identification - bump the version whenever PomodoroConfig changes
+#define CONFIG_BLOB_MAGIC 0x504F4D43 // "POMC"
+#define CONFIG_BLOB_VERSION 1
+
+// Refuse to parse anything larger than this, it is not a config file
+#define CONFIG_FILE_MAX_SIZE 4096
+
+struct ConfigBlob {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t length;      // sizeof(ConfigBlob), catches layout changes without a version bump
+  uint32_t sourceSize;  // Size of the file this blob was compiled from (0 if no file)
+  uint32_t sourceMtime; // Last write time of that file (0 if no file)
+  PomodoroConfig config;
+  uint32_t crc;         // CRC32 of everything above
+};
+
+static uint32_t blobCrc(const ConfigBlob &blob) {
+  return esp_rom_crc32_le(0, (const uint8_t *)&blob, offsetof(ConfigBlob, crc));
+}
+
+static bool readBlob(ConfigBlob &blob) {
+  Preferences prefs;
+  if (!prefs.begin(CONFIG_NVS_NAMESPACE, true)) {
+    return false;
+  }
+  size_t length = prefs.getBytes(CONFIG_NVS_KEY, &blob, sizeof(blob));
+  prefs.end();
+
+  return length == sizeof(blob) &&
+         blob.magic == CONFIG_BLOB_MAGIC &&
+         blob.version == CONFIG_BLOB_VERSION &&
+         blob.length == sizeof(blob) &&
+         blob.crc == blobCrc(blob);
+}
+
+static bool writeBlob(const PomodoroConfig &config, uint32_t sourceSize, uint32_t sourceMtime) {
+  ConfigBlob blob;
+  memset(&blob, 0, sizeof(blob));
+  blob.magic = CONFIG_BLOB_MAGIC;
+  blob.version = CONFIG_BLOB_VERSION;
+  blob.length = sizeof(blob);
+  blob.sourceSize = sourceSize;
+  blob.sourceMtime = sourceMtime;
+  memcpy(&blob.config, &config, sizeof(config));
+  blob.crc = blobCrc(blob);
+
+  Preferences prefs;
+  if (!prefs.begin(CONFIG_NVS_NAMESPACE, false)) {
+    return false;
+  }
+  bool ok = prefs.putBytes(CONFIG_NVS_KEY, &blob, sizeof(blob)) == sizeof(blob);
+  prefs.end();
+  return ok;
+}
+
+bool configLoadCached(PomodoroConfig &config) {
+  ConfigBlob blob;
+  if (!readBlob(blob)) {
+    return false;
+  }
+  config = blob.config;
+  return true;
+}
+
+static void printWarning(const char *message) {
+  Serial.printf("Config: %s\n", message);
+}
+
+static void parseFile(File &file, PomodoroConfig &config) {
+  size_t size = file.size();
+  if (size > CONFIG_FILE_MAX_SIZE) {
+    Serial.printf("Config file too large (%u bytes), using defaults\n", (unsigned)size);
+    configSetDefaults(config);
+    return;
+  }
+
+  // Read in one go, the parser works on the buffer (+1 so an empty file still allocates)
+  char *text = (char *)malloc(size + 1);
+  if (!text) {
+    Serial.println("Out of memory reading config file, using defaults");
+    configSetDefaults(config);
+    return;
+  }
+  size_t length = file.read((uint8_t *)text, size);
+  configParse(text, length, config, printWarning);
+  free(text);
+}
+
+bool configSaveDefaults(PomodoroConfig &config) {
+  configSetDefaults(config);
+  if (!writeBlob(config, 0, 0)) {
+    Serial.println("Failed to write config cache to NVS");
+    return false;
+  }
+  return true;
+}
+
+// The file is only treated as deleted when the card itself still answers,
+// so a pulled card or a transient error never wipes a good cache
+static bool fileMissing(fs::FS &fs) {
+  File root = fs.open("/");
+  bool healthy = root && root.isDirectory();
+  if (root) root.close();
+  return healthy && !fs.exists(CONFIG_FILE_PATH);
+}
+
+bool configSyncFromFile(fs::FS &fs, PomodoroConfig &config) {
+  ConfigBlob cached;
+  bool haveCache = readBlob(cached);
+
+  File file = fs.open(CONFIG_FILE_PATH, FILE_READ);
+  if (!file || file.isDirectory()) {
+    if (file) file.close();
+    if (!fileMissing(fs)) {
+      if (haveCache) {
+        Serial.printf("Cannot open %s, keeping cached config\n", CONFIG_FILE_PATH);
+        return false;
+      }
+      // Nothing cached to keep, cache the defaults so later boots skip the SD card
+      Serial.printf("Cannot open %s, using defaults\n", CONFIG_FILE_PATH);
+      return configSaveDefaults(config);
+    }
+
+    // A missing file compiles to the defaults with a zero stamp
+    if (haveCache && cached.sourceSize == 0 && cached.sourceMtime == 0) {
+      return false;
+    }
+    Serial.printf("%s not found, using defaults\n", CONFIG_FILE_PATH);
+    return configSaveDefaults(config);
+  }
+
+  uint32_t sourceSize = file.size();
+  uint32_t sourceMtime = (uint32_t)file.getLastWrite();
+  if (haveCache && cached.sourceSize == sourceSize && cached.sourceMtime == sourceMtime) {
+    file.close();
+    return false;
+  }
+
+  Serial.printf("Compiling %s (%u bytes)\n", CONFIG_FILE_PATH, (unsigned)sourceSize);
+  parseFile(file, config);
+  file.close();
+
+  if (!writeBlob(config, sourceSize, sourceMtime)) {
+    Serial.println("Failed to write config cache to NVS");
+    return false;
+  }
+  return true;
+}
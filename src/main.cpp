@@ -4,6 +4,7 @@
 #include <M5Unified.h>
 #include <M5GFX.h>
 #include <esp_ota_ops.h>
+#include "config.h"
 
 // Forward declarations
 void drawButton(int x, int y, int w, int h, String text, uint32_t color);
@@ -15,24 +16,25 @@ void updateBatteryInfo();
 void displayLockScreen();
 void redrawAllButtons();
 
+// Runtime configuration (loaded from NVS cache, compiled from SD card file)
+PomodoroConfig pomodoroConfig;
+
 // Global variables for animation
 int timerCenterX, timerCenterY;
-int outerRadius = 220;
-int innerRadius = 170;
+int outerRadius; // Set from config in setup
+int innerRadius; // Set from config in setup
 int currentSecond = 0;
 int currentMinute = 0;
 unsigned long lastSecondUpdate = 0;
 bool animationRunning = false;
 bool timerPaused = false;
-int timerDuration = 25; // Default 25 minutes
+int timerDuration; // Set from the first preset in setup
 
 // Deep sleep variables
 unsigned long lastActivityTime = 0;
-const unsigned long SLEEP_TIMEOUT = 5 * 60 * 1000; // 5 minutes in milliseconds
 
 // Battery monitoring variables
 unsigned long lastBatteryCheck = 0;
-const unsigned long BATTERY_CHECK_INTERVAL = 60 * 1000; // Check every 60 seconds
 int batteryLevel = 0;
 bool isCharging = false;
 
@@ -155,8 +157,8 @@ void updateAnimation() {
         updateInnerDot(innerDotIndex, TFT_WHITE);
       }
       
-      // Full refresh every 5 minutes to prevent ghosting
-      if (currentMinute % 5 == 0) {
+      // Periodic full refresh to prevent ghosting
+      if (pomodoroConfig.antiGhostMinutes > 0 && currentMinute % pomodoroConfig.antiGhostMinutes == 0) {
         M5.Display.fillScreen(TFT_WHITE);
         drawCircularTimer(timerCenterX, timerCenterY, timerDuration);
         
@@ -306,7 +308,7 @@ void drawBatteryIcon(int x, int y, int percentage, bool charging) {
 
 void updateBatteryInfo() {
   unsigned long currentTime = millis();
-  if (currentTime - lastBatteryCheck >= BATTERY_CHECK_INTERVAL) {
+  if (currentTime - lastBatteryCheck >= pomodoroConfig.batteryCheckIntervalMs) {
     batteryLevel = M5.Power.getBatteryLevel();
     isCharging = M5.Power.isCharging();
     lastBatteryCheck = currentTime;
@@ -326,9 +328,9 @@ void redrawAllButtons() {
   drawIconButton(buttons[0].x, buttons[0].y, buttons[0].w, buttons[0].h, "play", TFT_WHITE);
   drawIconButton(buttons[1].x, buttons[1].y, buttons[1].w, buttons[1].h, "pause", TFT_WHITE);
   drawIconButton(buttons[2].x, buttons[2].y, buttons[2].w, buttons[2].h, "stop", TFT_WHITE);
-  drawButton(buttons[3].x, buttons[3].y, buttons[3].w, buttons[3].h, "25Min", TFT_WHITE);
-  drawButton(buttons[4].x, buttons[4].y, buttons[4].w, buttons[4].h, "5Min", TFT_WHITE);
-  drawButton(buttons[5].x, buttons[5].y, buttons[5].w, buttons[5].h, "30Min", TFT_WHITE);
+  drawButton(buttons[3].x, buttons[3].y, buttons[3].w, buttons[3].h, buttons[3].label, TFT_WHITE);
+  drawButton(buttons[4].x, buttons[4].y, buttons[4].w, buttons[4].h, buttons[4].label, TFT_WHITE);
+  drawButton(buttons[5].x, buttons[5].y, buttons[5].w, buttons[5].h, buttons[5].label, TFT_WHITE);
   drawRefreshButton(buttons[6].x, buttons[6].y, buttons[6].w, buttons[6].h, TFT_WHITE);
 }
 
@@ -394,24 +396,24 @@ void handleButtonPress(int buttonIndex) {
         drawBatteryIcon(10, 10, batteryLevel, isCharging);
       }
       break;
-    case 3: // 25Min button
-      timerDuration = 25;
+    case 3: // First preset button (25Min by default)
+      timerDuration = pomodoroConfig.presetMinutes[0];
       stopAnimation();
       // Redraw entire timer display with new duration
       M5.Display.fillScreen(TFT_WHITE);
       drawCircularTimer(timerCenterX, timerCenterY, timerDuration);
       M5.Display.display(); // Full refresh when changing preset
       break;
-    case 4: // 5Min button
-      timerDuration = 5;
+    case 4: // Second preset button (5Min by default)
+      timerDuration = pomodoroConfig.presetMinutes[1];
       stopAnimation();
       // Redraw entire timer display with new duration
       M5.Display.fillScreen(TFT_WHITE);
       drawCircularTimer(timerCenterX, timerCenterY, timerDuration);
       M5.Display.display(); // Full refresh when changing preset
       break;
-    case 5: // 30Min button
-      timerDuration = 30;
+    case 5: // Third preset button (30Min by default)
+      timerDuration = pomodoroConfig.presetMinutes[2];
       stopAnimation();
       // Redraw entire timer display with new duration
       M5.Display.fillScreen(TFT_WHITE);
@@ -518,6 +520,15 @@ void checkButtonTouch() {
   }
 }
 
+bool mountSdCard() {
+  // Mounted on demand so boot and wake don't pay for it
+  if (!sdCardInitialized) {
+    SPI.begin(SD_SPI_SCK_PIN, SD_SPI_MISO_PIN, SD_SPI_MOSI_PIN, SD_SPI_CS_PIN);
+    sdCardInitialized = SD.begin(SD_SPI_CS_PIN, SPI, 25000000);
+  }
+  return sdCardInitialized;
+}
+
 void displayLockScreen() {
   if (sdCardInitialized) {
     // Clear screen first
@@ -553,7 +564,13 @@ void checkDeepSleep() {
   // Only go to deep sleep if timer is not running and not paused
   if (!animationRunning && !timerPaused) {
     unsigned long currentTime = millis();
-    if (currentTime - lastActivityTime > SLEEP_TIMEOUT) {
+    if (currentTime - lastActivityTime > pomodoroConfig.sleepTimeoutMs) {
+      // Pick up config file edits while the SD card is mounted for the lock screen,
+      // the recompiled cache takes effect on wake
+      if (mountSdCard()) {
+        configSyncFromFile(SD, pomodoroConfig);
+      }
+      
       // Display lock screen image before deep sleep
       displayLockScreen();
       
@@ -577,16 +594,23 @@ void setup() {
   M5.Display.setRotation(2); // Portrait mode
   M5.Display.fillScreen(TFT_WHITE);
   
-  // Set speaker volume (0-255)
-  M5.Speaker.setVolume(200);
-  
-  // Initialize SD card
-  SPI.begin(SD_SPI_SCK_PIN, SD_SPI_MISO_PIN, SD_SPI_MOSI_PIN, SD_SPI_CS_PIN);
-  if (SD.begin(SD_SPI_CS_PIN, SPI, 25000000)) {
-    sdCardInitialized = true;
+  // Load configuration from the NVS cache (single read, no SD card access).
+  // Only compile the SD card file now if there is no valid cache yet. Without a card
+  // (or a readable file) the defaults are cached and the file is picked up on a later sleep.
+  configSetDefaults(pomodoroConfig);
+  if (configLoadCached(pomodoroConfig)) {
+    Serial.println("Config loaded from NVS cache");
+  } else if (mountSdCard()) {
+    configSyncFromFile(SD, pomodoroConfig);
   } else {
-    sdCardInitialized = false;
+    configSaveDefaults(pomodoroConfig);
   }
+  outerRadius = pomodoroConfig.outerRadius;
+  innerRadius = pomodoroConfig.innerRadius;
+  timerDuration = pomodoroConfig.presetMinutes[0];
+  
+  // Set speaker volume (0-255)
+  M5.Speaker.setVolume(pomodoroConfig.speakerVolume);
   
   // Initialize last activity time
   lastActivityTime = millis();
@@ -603,7 +627,7 @@ void setup() {
   // Set global timer center position
   timerCenterX = screenWidth / 2;
   timerCenterY = screenHeight / 3;
-  drawCircularTimer(timerCenterX, timerCenterY, 25);
+  drawCircularTimer(timerCenterX, timerCenterY, timerDuration);
   
   // Add title text between circle and buttons
   int titleY = timerCenterY + 300; // Position even lower, away from circles
@@ -631,11 +655,11 @@ void setup() {
   buttons[1] = {startX + buttonWidth + buttonSpacing, row1Y, buttonWidth, buttonHeight, "icon", "pause"};
   buttons[2] = {startX + 2 * (buttonWidth + buttonSpacing), row1Y, buttonWidth, buttonHeight, "icon", "stop"};
   
-  // Second row buttons: 25Min, 5Min, 30Min
+  // Second row buttons: timer presets (25Min, 5Min, 30Min by default)
   int row2Y = row1Y + buttonHeight + verticalSpacing;
-  buttons[3] = {startX, row2Y, buttonWidth, buttonHeight, "text", "25Min"};
-  buttons[4] = {startX + buttonWidth + buttonSpacing, row2Y, buttonWidth, buttonHeight, "text", "5Min"};
-  buttons[5] = {startX + 2 * (buttonWidth + buttonSpacing), row2Y, buttonWidth, buttonHeight, "text", "30Min"};
+  buttons[3] = {startX, row2Y, buttonWidth, buttonHeight, "text", String(pomodoroConfig.presetMinutes[0]) + "Min"};
+  buttons[4] = {startX + buttonWidth + buttonSpacing, row2Y, buttonWidth, buttonHeight, "text", String(pomodoroConfig.presetMinutes[1]) + "Min"};
+  buttons[5] = {startX + 2 * (buttonWidth + buttonSpacing), row2Y, buttonWidth, buttonHeight, "text", String(pomodoroConfig.presetMinutes[2]) + "Min"};
   
   // Refresh button in top right corner
   int refreshSize = 40;
@@ -0,0 +1,182 @@
+#include <string.h>
+#include <unity.h>
+#include <config_parser.h>
+
+static PomodoroConfig config;
+static int warnings;
+
+static void countWarning(const char *message) {
+  (void)message;
+  warnings++;
+}
+
+static void parse(const char *text) {
+  configParse(text, strlen(text), config, countWarning);
+}
+
+static void assertDefaults() {
+  PomodoroConfig defaults;
+  configSetDefaults(defaults);
+  TEST_ASSERT_EQUAL(defaults.sleepTimeoutMs, config.sleepTimeoutMs);
+  TEST_ASSERT_EQUAL(defaults.batteryCheckIntervalMs, config.batteryCheckIntervalMs);
+  TEST_ASSERT_EQUAL(defaults.presetMinutes[0], config.presetMinutes[0]);
+  TEST_ASSERT_EQUAL(defaults.presetMinutes[1], config.presetMinutes[1]);
+  TEST_ASSERT_EQUAL(defaults.presetMinutes[2], config.presetMinutes[2]);
+  TEST_ASSERT_EQUAL(defaults.antiGhostMinutes, config.antiGhostMinutes);
+  TEST_ASSERT_EQUAL(defaults.outerRadius, config.outerRadius);
+  TEST_ASSERT_EQUAL(defaults.innerRadius, config.innerRadius);
+  TEST_ASSERT_EQUAL(defaults.speakerVolume, config.speakerVolume);
+}
+
+void setUp() {
+  memset(&config, 0xAA, sizeof(config));
+  warnings = 0;
+}
+
+void tearDown() {}
+
+void test_empty_file_gives_defaults() {
+  parse("");
+  assertDefaults();
+  TEST_ASSERT_EQUAL(0, warnings);
+}
+
+void test_all_keys() {
+  parse("preset_1_min = 50\n"
+        "preset_2_min = 10\n"
+        "preset_3_min = 15\n"
+        "sleep_timeout_sec = 600\n"
+        "battery_check_sec = 30\n"
+        "anti_ghost_min = 0\n"
+        "speaker_volume = 80\n"
+        "outer_radius = 240\n"
+        "inner_radius = 190\n");
+  TEST_ASSERT_EQUAL(0, warnings);
+  TEST_ASSERT_EQUAL(50, config.presetMinutes[0]);
+  TEST_ASSERT_EQUAL(10, config.presetMinutes[1]);
+  TEST_ASSERT_EQUAL(15, config.presetMinutes[2]);
+  TEST_ASSERT_EQUAL(600000, config.sleepTimeoutMs);
+  TEST_ASSERT_EQUAL(30000, config.batteryCheckIntervalMs);
+  TEST_ASSERT_EQUAL(0, config.antiGhostMinutes);
+  TEST_ASSERT_EQUAL(80, config.speakerVolume);
+  TEST_ASSERT_EQUAL(240, config.outerRadius);
+  TEST_ASSERT_EQUAL(190, config.innerRadius);
+}
+
+void test_comments_and_whitespace() {
+  parse("# comment\n"
+        "\n"
+        "   \t\n"
+        "  speaker_volume\t=  90   # trailing comment\n");
+  TEST_ASSERT_EQUAL(0, warnings);
+  TEST_ASSERT_EQUAL(90, config.speakerVolume);
+}
+
+void test_bom_crlf_and_missing_final_newline() {
+  parse("\xEF\xBB\xBFpreset_1_min = 40\r\nspeaker_volume = 90");
+  TEST_ASSERT_EQUAL(0, warnings);
+  TEST_ASSERT_EQUAL(40, config.presetMinutes[0]);
+  TEST_ASSERT_EQUAL(90, config.speakerVolume);
+}
+
+void test_not_null_terminated() {
+  const char text[] = "speaker_volume = 90speaker_volume = 10";
+  configParse(text, 19, config, countWarning);
+  TEST_ASSERT_EQUAL(0, warnings);
+  TEST_ASSERT_EQUAL(90, config.speakerVolume);
+}
+
+void test_unknown_key_and_missing_separator() {
+  parse("volume = 10\n"
+        "speaker_volume 10\n");
+  TEST_ASSERT_EQUAL(2, warnings);
+  assertDefaults();
+}
+
+void test_invalid_values_keep_defaults() {
+  parse("speaker_volume = 256\n"
+        "preset_1_min = 0\n"
+        "preset_2_min = 100\n"
+        "sleep_timeout_sec = 29\n"
+        "battery_check_sec = 5s\n"
+        "anti_ghost_min =\n"
+        "outer_radius = 89\n"
+        "inner_radius = 241\n");
+  TEST_ASSERT_EQUAL(8, warnings);
+  assertDefaults();
+}
+
+void test_range_limits_accepted() {
+  parse("speaker_volume = 0\n"
+        "preset_1_min = 1\n"
+        "sleep_timeout_sec = 86400\n"
+        "battery_check_sec = 5\n");
+  TEST_ASSERT_EQUAL(0, warnings);
+  TEST_ASSERT_EQUAL(0, config.speakerVolume);
+  TEST_ASSERT_EQUAL(1, config.presetMinutes[0]);
+  TEST_ASSERT_EQUAL(86400000, config.sleepTimeoutMs);
+  TEST_ASSERT_EQUAL(5000, config.batteryCheckIntervalMs);
+}
+
+void test_rings_too_close_use_default_radii() {
+  parse("outer_radius = 200\n"
+        "inner_radius = 190\n");
+  TEST_ASSERT_EQUAL(1, warnings);
+  TEST_ASSERT_EQUAL(220, config.outerRadius);
+  TEST_ASSERT_EQUAL(170, config.innerRadius);
+}
+
+void test_preset_too_long_for_inner_ring_uses_default() {
+  parse("preset_1_min = 82\n"
+        "preset_3_min = 83\n");
+  TEST_ASSERT_EQUAL(1, warnings);
+  TEST_ASSERT_EQUAL(82, config.presetMinutes[0]);
+  TEST_ASSERT_EQUAL(30, config.presetMinutes[2]);
+}
+
+void test_long_preset_fits_larger_inner_ring() {
+  parse("outer_radius = 260\n"
+        "inner_radius = 240\n"
+        "preset_1_min = 99\n");
+  TEST_ASSERT_EQUAL(0, warnings);
+  TEST_ASSERT_EQUAL(99, config.presetMinutes[0]);
+}
+
+void test_inner_ring_too_small_for_default_presets() {
+  // 30 dots don't fit on a 60px ring, so the radii fall back too
+  parse("inner_radius = 60\n"
+        "outer_radius = 100\n"
+        "preset_1_min = 20\n");
+  TEST_ASSERT_EQUAL(1, warnings);
+  TEST_ASSERT_EQUAL(220, config.outerRadius);
+  TEST_ASSERT_EQUAL(170, config.innerRadius);
+  TEST_ASSERT_EQUAL(20, config.presetMinutes[0]);
+}
+
+void test_dots_fit() {
+  TEST_ASSERT_TRUE(configDotsFit(1, 0, 13));
+  TEST_ASSERT_TRUE(configDotsFit(82, 170, 13));
+  TEST_ASSERT_FALSE(configDotsFit(83, 170, 13));
+  TEST_ASSERT_FALSE(configDotsFit(30, 60, 13));
+  // Smallest accepted outer ring still fits the 60 second dots
+  TEST_ASSERT_TRUE(configDotsFit(60, 90, 9));
+  TEST_ASSERT_FALSE(configDotsFit(60, 80, 9));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_empty_file_gives_defaults);
+  RUN_TEST(test_all_keys);
+  RUN_TEST(test_comments_and_whitespace);
+  RUN_TEST(test_bom_crlf_and_missing_final_newline);
+  RUN_TEST(test_not_null_terminated);
+  RUN_TEST(test_unknown_key_and_missing_separator);
+  RUN_TEST(test_invalid_values_keep_defaults);
+  RUN_TEST(test_range_limits_accepted);
+  RUN_TEST(test_rings_too_close_use_default_radii);
+  RUN_TEST(test_preset_too_long_for_inner_ring_uses_default);
+  RUN_TEST(test_long_preset_fits_larger_inner_ring);
+  RUN_TEST(test_inner_ring_too_small_for_default_presets);
+  RUN_TEST(test_dots_fit);
+  return UNITY_END();
+}